@@ -147,6 +147,8 @@ struct Verbose
     // collect and list statistics on template instantiations origins.
     // TODO: make this an enum when we want to list other kinds of instances
     d_bool templatesListInstances;
+    d_bool templatesStats;     // list hash table statistics of template instance lookups
+    d_bool ctfe;               // collect and list statistics on CTFE
     d_bool gc;                 // identify gc usage
     d_bool field;              // identify non-mutable field variables
     d_bool complex = true;     // identify complex/imaginary type usage
@@ -185,6 +187,7 @@ struct Param
     d_bool multiobj;      // break one object file into multiple ones
     d_bool trace;         // insert profiling hooks
     d_bool tracegc;       // instrument calls to 'new'
+    d_bool traceSample;   // start the sampling profiler from C main
     d_bool vcg_ast;       // write-out codegen-ast
     d_bool useUnitTests;  // generate unittest code
     d_bool useInline;     // inline expand functions
@@ -268,6 +271,7 @@ struct Param
     Output makeDeps;          // Generate make file dependencies
     Output mixinOut;          // write expanded mixins for debugging
     Output moduleDeps;        // Generate `.deps` module dependencies
+    Output fingerprints;      // Generate module fingerprints for incremental builds
 
     d_bool debugEnabled;   // -debug flag is passed
 
@@ -276,6 +280,7 @@ struct Param
 
     Array<const char *> cppswitches; // preprocessor switches
     const char *cpp;                 // if not null, then this specifies the C preprocessor
+    const char *cppCacheDir;         // if not null, cache preprocessed C files in this directory
 
     // Linker stuff
     Array<const char *> objfiles;
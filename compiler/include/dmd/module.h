@@ -80,6 +80,10 @@ public:
     ThreeState selfimports;
     ThreeState rootimports;
     void* tagSymTab;            // ImportC: tag symbols that conflict with other symbols used as the index
+    unsigned char sourceDigest[32];     // -fingerprints: digest of the source text
+    unsigned char interfaceDigest[32];  // -fingerprints: digest of the generated 'header' text
+    d_bool hasFingerprint;      // sourceDigest and interfaceDigest are set
+    d_bool bodiesUsed;          // a function body was evaluated at compile time or inlined
     OutBuffer defines;          // collect all the #define lines here
     bool selfImports();         // returns true if module imports itself
 
@@ -0,0 +1,9 @@
+// preprocessed ahead of time with -j
+
+#if __IMPORTC__
+__module imports.jobs_c;
+#endif
+
+#define OFFSET 1
+
+int next(int x) { return x + OFFSET; }
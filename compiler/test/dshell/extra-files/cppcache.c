@@ -0,0 +1,6 @@
+#include <stddef.h>
+#include "cppcache.h"
+
+#define SQUARE(x) ((x) * (x))
+
+size_t square(size_t x) { return SQUARE(x) + OFFSET; }